@@ -0,0 +1,81 @@
+#!/bin/bash
+
+if [ -z $2 ]; then
+	echo "Usage: ./merfin_bench.sh <bin> <workdir> [threads] [merfin-synth options]"
+	echo
+	echo "  bin        directory with merfin, merfin-synth and meryl (build/bin)"
+	echo "  workdir    directory for the synthetic data and results; data is reused if present"
+	echo "  threads    threads for meryl and merfin (default: 8)"
+	echo
+	echo "  Makes a synthetic assembly, reads and vcf with merfin-synth, counts 21-mers"
+	echo "  with meryl, then times merfin -hist, -dump and -vmer."
+	echo "  Each run writes its -report to <workdir>/<mode>.json; a summary of the"
+	echo "  phases is printed on stdout as: mode <tab> phase <tab> wall <tab> cpu <tab> maxRSSSoFar <tab> kmers/s/thread"
+	echo "  Then -vmer is run again with 1, 2, 4, ... threads, up to 'threads', and the"
+	echo "  wall time of its scoring phase is printed as: threads <tab> wall <tab> speedup"
+	echo
+	echo "  The default data is 4 x 5 Mbp, 30x reads and 1 variant per kbp."
+	echo "  Change it with merfin-synth options, e.g. -density 10 for 10 variants per kbp."
+	echo "  Delete the workdir after changing them."
+	exit -1
+fi
+
+bin=$1
+out=$2
+threads=$3
+if [ -z $threads ]; then
+  threads=8
+fi
+shift; shift; shift
+
+set -e
+mkdir -p $out
+
+if [ ! -e $out/synth.peak ]; then
+  $bin/merfin-synth -output $out/synth "$@" > $out/synth.peak
+fi
+peak=`cat $out/synth.peak`
+
+if [ ! -d $out/asm.meryl ]; then
+  $bin/meryl count k=21 threads=$threads $out/synth.asm.fasta   output $out/asm.meryl
+fi
+if [ ! -d $out/reads.meryl ]; then
+  $bin/meryl count k=21 threads=$threads $out/synth.reads.fasta output $out/reads.meryl
+fi
+
+inputs="-sequence $out/synth.asm.fasta -seqmers $out/asm.meryl -readmers $out/reads.meryl -peak $peak"
+args="$inputs -threads $threads"
+
+$bin/merfin -hist $args -output $out/hist      -report $out/hist.json 2> $out/hist.log
+$bin/merfin -dump $args -output $out/dump.gz   -report $out/dump.json 2> $out/dump.log
+$bin/merfin -vmer $args -output $out/vmer -vcf $out/synth.vcf -report $out/vmer.json 2> $out/vmer.log
+
+for mode in hist dump vmer ; do
+  grep '"name"' $out/$mode.json | \
+  sed 's/[{}",:]/ /g' | \
+  awk -v m=$mode '{ for (i=1; i<NF; i++) v[$i]=$(i+1); n=$0; sub(/ *name  */, "", n); sub(/  *threads.*/, "", n); print m "\t" n "\t" v["wall"] "\t" v["cpu"] "\t" v["maxRSSSoFar"] "\t" v["kmersPerSecPerThread"] }'
+done
+
+#  Thread scaling of -vmer scoring, against 1 thread.
+
+echo
+echo -e "threads\twall\tspeedup"
+
+base=
+t=1
+while [ $t -le $threads ] ; do
+  $bin/merfin -vmer $inputs -threads $t -output $out/scale.$t -vcf $out/synth.vcf -report $out/scale.$t.json 2> $out/scale.$t.log
+
+  wall=`grep '"name": "vmer"' $out/scale.$t.json | sed 's/.*"wall": \([0-9.]*\).*/\1/'`
+  if [ -z $base ]; then
+    base=$wall
+  fi
+
+  awk -v t=$t -v b=$base -v w=$wall 'BEGIN { printf "%d\t%.3f\t%.2f\n", t, w, (w > 0) ? b / w : 0 }'
+
+  if [ $t -lt $threads ] && [ $((t * 2)) -gt $threads ]; then
+    t=$threads
+  else
+    t=$((t * 2))
+  fi
+done
@@ -57,6 +57,8 @@ SRC_INCDIRS  := . \
                 utility/src/utility
 
 SUBMAKEFILES := merfin/merfin.mk \
+                merfin/merfin-dump.mk \
+                merfin/merfin-synth.mk \
                 meryl/src/meryl/meryl.mk
 
 #ifeq ($(BUILDTESTS), 1)
@@ -0,0 +1,10 @@
+TARGET   := merfin-dump
+SOURCES  := merfin-dump.C kdump.C kmetric.C
+
+SRC_INCDIRS  := . ../utility/src/utility
+
+TGT_LDFLAGS := -L${TARGET_DIR}/lib
+TGT_LDLIBS  := -lmerfin
+TGT_PREREQS := libmerfin.a
+
+SUBMAKEFILES :=
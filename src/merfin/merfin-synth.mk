@@ -0,0 +1,10 @@
+TARGET   := merfin-synth
+SOURCES  := merfin-synth.C
+
+SRC_INCDIRS  := . ../utility/src/utility
+
+TGT_LDFLAGS := -L${TARGET_DIR}/lib
+TGT_LDLIBS  := -lmerfin
+TGT_PREREQS := libmerfin.a
+
+SUBMAKEFILES :=
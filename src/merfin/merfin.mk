@@ -1,5 +1,5 @@
 TARGET   := merfin
-SOURCES  := merfin.C vcf.C varMer.C kmetric.C
+SOURCES  := merfin.C vcf.C varMer.C kmetric.C kdump.C kstarHist.C lookupImage.C runStats.C
 
 SRC_INCDIRS  := . ../utility/src/utility
 